@@ -0,0 +1,95 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+// Minimal micro-benchmark harness.
+// Each case is a function that runs the operation 'iters' times. The harness
+// calibrates 'iters' so one repetition takes about BENCH_REP_NS, runs
+// BENCH_WARMUP untimed repetitions, then BENCH_REPS timed ones, and reports
+// ns/op statistics plus ops/sec (from the median) as JSON on 'out'.
+
+#define BENCH_WARMUP 3
+#define BENCH_REPS   15
+#define BENCH_REP_NS 5e6    // Target duration of one repetition (5 ms)
+
+typedef void (*BenchFn)(void *ctx, long iters);
+
+// Written by benchmark cases so the compiler cannot drop the work
+static volatile double bench_sink;
+
+static FILE *bench_out;
+static int bench_count = 0;
+
+static inline double bench_now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int bench_cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static inline void bench_begin(FILE *out) {
+    bench_out = out;
+    bench_count = 0;
+    fprintf(bench_out, "{\n  \"warmup\": %d,\n  \"reps\": %d,\n  \"benchmarks\": [", BENCH_WARMUP, BENCH_REPS);
+}
+
+static inline void bench_end() {
+    fprintf(bench_out, "\n  ]\n}\n");
+    fflush(bench_out);
+}
+
+// FUNCTION: bench_run
+// LOGIC: Calibrate -> warmup -> timed repetitions -> statistics -> JSON entry.
+//        'param' is the swept variable (e.g. obstacle count), -1 if none.
+static inline void bench_run(const char *name, long param, BenchFn fn, void *ctx) {
+    // Calibration: double iters until one repetition is long enough
+    long iters = 1;
+    while (1) {
+        double t0 = bench_now_ns();
+        fn(ctx, iters);
+        double dt = bench_now_ns() - t0;
+        if (dt >= BENCH_REP_NS / 4 || iters >= (1L << 30)) {
+            if (dt > 0) iters = (long)(iters * (BENCH_REP_NS / dt)) + 1;
+            break;
+        }
+        iters *= 2;
+    }
+
+    for (int r = 0; r < BENCH_WARMUP; r++) fn(ctx, iters);
+
+    double ns[BENCH_REPS];
+    for (int r = 0; r < BENCH_REPS; r++) {
+        double t0 = bench_now_ns();
+        fn(ctx, iters);
+        ns[r] = (bench_now_ns() - t0) / iters;
+    }
+
+    double sum = 0, sq = 0;
+    for (int r = 0; r < BENCH_REPS; r++) sum += ns[r];
+    double mean = sum / BENCH_REPS;
+    for (int r = 0; r < BENCH_REPS; r++) sq += (ns[r] - mean) * (ns[r] - mean);
+    double stddev = sqrt(sq / (BENCH_REPS - 1));
+    qsort(ns, BENCH_REPS, sizeof(double), bench_cmp_double);
+    double median = ns[BENCH_REPS / 2];
+
+    fprintf(bench_out, "%s\n    {\"name\": \"%s\", \"param\": %ld, \"iters\": %ld, "
+            "\"ns_per_op\": {\"median\": %.3f, \"mean\": %.3f, \"stddev\": %.3f, \"min\": %.3f, \"max\": %.3f}, "
+            "\"ops_per_sec\": %.1f}",
+            bench_count++ ? "," : "", name, param, iters,
+            median, mean, stddev, ns[0], ns[BENCH_REPS - 1], 1e9 / median);
+
+    // Human readable summary on stderr, JSON stays clean on stdout
+    fprintf(stderr, "%-24s %6ld  %12.1f ns/op  (+/- %5.1f)  %14.0f ops/s\n",
+            name, param, median, stddev, 1e9 / median);
+}
+
+#endif
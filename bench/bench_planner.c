@@ -0,0 +1,91 @@
+#include "common.h"
+#include "planner.h"
+
+// Replanning benchmark for the autopilot's incremental planner.
+// For each world size and obstacle density it measures:
+//   cold      - a fresh planner solving the world from scratch
+//   obstacle  - incremental repair after one obstacle spawns (oldest despawns)
+//   target    - incremental repair after one target respawns elsewhere
+// 'cold' on the same changed world is what a from-scratch planner would pay.
+
+#define REPS 200
+
+static double now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static Point random_cell(int w, int h) {
+    Point p = { rand() % (w - 2) + 1, rand() % (h - 2) + 1 };
+    return p;
+}
+
+static void run(int w, int h, float density) {
+    int n_obs = (int)(density * w * h);
+    if (n_obs < 1) n_obs = 1;
+    Point *obs = malloc(n_obs * sizeof(Point));
+    Point tar[MAX_TARGETS];
+    for (int i = 0; i < n_obs; i++) obs[i] = random_cell(w, h);
+    for (int i = 0; i < MAX_TARGETS; i++) tar[i] = random_cell(w, h);
+    int sx = w / 2, sy = h / 2;
+    Point next;
+
+    double t_cold = 0, t_obs = 0, t_tar = 0;
+    long e_cold = 0, e_obs = 0, e_tar = 0;
+
+    Planner *inc = planner_create(w, h, PLANNER_CLEARANCE);
+    planner_set_world(inc, obs, n_obs, tar, MAX_TARGETS);
+    planner_next_step(inc, sx, sy, &next);
+
+    for (int r = 0; r < REPS; r++) {
+        // Obstacle spawn: replace the oldest one (ring buffer like the server)
+        obs[r % n_obs] = random_cell(w, h);
+        long e0 = inc->expanded;
+        double t0 = now_us();
+        planner_set_world(inc, obs, n_obs, tar, MAX_TARGETS);
+        planner_next_step(inc, sx, sy, &next);
+        t_obs += now_us() - t0;
+        e_obs += inc->expanded - e0;
+
+        // Target spawn
+        tar[r % MAX_TARGETS] = random_cell(w, h);
+        e0 = inc->expanded;
+        t0 = now_us();
+        planner_set_world(inc, obs, n_obs, tar, MAX_TARGETS);
+        planner_next_step(inc, sx, sy, &next);
+        t_tar += now_us() - t0;
+        e_tar += inc->expanded - e0;
+
+        // Same world, solved from scratch
+        t0 = now_us();
+        Planner *cold = planner_create(w, h, PLANNER_CLEARANCE);
+        planner_set_world(cold, obs, n_obs, tar, MAX_TARGETS);
+        planner_next_step(cold, sx, sy, &next);
+        t_cold += now_us() - t0;
+        e_cold += cold->expanded;
+        planner_destroy(cold);
+    }
+    planner_destroy(inc);
+    free(obs);
+
+    printf("%4dx%-4d %6.1f%% %6d | %10.1f %8ld | %10.1f %8ld | %10.1f %8ld\n",
+           w, h, density * 100.0f, n_obs,
+           t_cold / REPS, e_cold / REPS,
+           t_obs / REPS, e_obs / REPS,
+           t_tar / REPS, e_tar / REPS);
+}
+
+int main(void) {
+    srand(42);
+    static const int sizes[][2] = { {50, 20}, {100, 30}, {200, 60}, {400, 120}, {800, 240} };
+    static const float densities[] = { 0.005f, 0.02f, 0.05f };
+
+    printf("Planner replanning time (mean of %d reps, us / cells expanded)\n", REPS);
+    printf("%-9s %7s %6s | %19s | %19s | %19s\n", "world", "density", "obs",
+           "cold (scratch)", "obstacle spawn", "target spawn");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        for (size_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++)
+            run(sizes[s][0], sizes[s][1], densities[d]);
+    return 0;
+}
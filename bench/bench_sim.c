@@ -0,0 +1,125 @@
+#include "common.h"
+#include "sim.h"
+#include "bench.h"
+
+// Micro-benchmarks for the simulation hot paths (libsim + log_message).
+// Usage: bench_sim [results.json]   (JSON goes to stdout if no file given)
+
+typedef struct {
+    Point obstacles[100];
+    int n_obs;
+    Point targets[MAX_TARGETS];
+    char msg[BUF_SIZE];
+    const char *log_file;
+} BenchWorld;
+
+static BenchWorld world;
+
+static void random_points(Point *p, int n) {
+    for (int i = 0; i < n; i++) {
+        p[i].x = rand() % (DEFAULT_WIDTH - 2) + 1;
+        p[i].y = rand() % (DEFAULT_HEIGHT - 2) + 1;
+    }
+}
+
+// --- CASES ---
+
+static void case_repulsion(void *ctx, long iters) {
+    BenchWorld *wd = ctx;
+    float rx, ry, acc = 0;
+    for (long i = 0; i < iters; i++) {
+        float x = 5.0f + (i & 63), y = 3.0f + (i & 15);
+        calc_repulsion(x, y, DEFAULT_WIDTH, DEFAULT_HEIGHT, wd->obstacles, wd->n_obs,
+                       DEFAULT_ETA, DEFAULT_RHO, &rx, &ry);
+        acc += rx + ry;
+    }
+    bench_sink = acc;
+}
+
+static void case_encode(void *ctx, long iters) {
+    BenchWorld *wd = ctx;
+    long acc = 0;
+    for (long i = 0; i < iters; i++)
+        acc += encode_world_state(wd->msg, DEFAULT_WIDTH, DEFAULT_HEIGHT, (float)(i & 7), -1.0f,
+                                  wd->obstacles, wd->targets);
+    bench_sink = acc;
+}
+
+static void case_parse(void *ctx, long iters) {
+    BenchWorld *wd = ctx;
+    Point obs[MAX_OBSTACLES], tar[MAX_TARGETS];
+    int w, h; float fx, fy;
+    long acc = 0;
+    for (long i = 0; i < iters; i++) {
+        parse_world_state(wd->msg, &w, &h, &fx, &fy, obs, tar);
+        acc += obs[MAX_OBSTACLES - 1].x + tar[MAX_TARGETS - 1].y;
+    }
+    bench_sink = acc;
+}
+
+// The swept segment runs along y = -5, outside the world where no
+// target/obstacle lies, so every candidate is tested and nothing is
+// consumed or logged.
+static void case_collisions(void *ctx, long iters) {
+    BenchWorld *wd = ctx;
+    int collected = 0, hits = 0;
+    for (long i = 0; i < iters; i++) {
+        float x0 = (float)(i & 63);
+        check_collisions(wd->targets, wd->obstacles, x0, -5.0f, x0 + 1.5f, -5.0f, &collected, &hits);
+    }
+    bench_sink = collected + hits;
+}
+
+static void case_integrate(void *ctx, long iters) {
+    float curr = 50.0f, prev = 50.0f;
+    for (long i = 0; i < iters; i++) {
+        float next = integrate_step((i & 1) ? 1.0f : -1.0f, curr, prev, DEFAULT_M, DEFAULT_K, DEFAULT_T);
+        prev = curr; curr = next;
+    }
+    bench_sink = curr;
+}
+
+// The log is truncated once per call (repetition) so it stays small.
+static void case_log(void *ctx, long iters) {
+    BenchWorld *wd = ctx;
+    truncate(wd->log_file, 0);
+    for (long i = 0; i < iters; i++)
+        log_message(wd->log_file, "POS:(50.00,15.00) CMD:(1.0,0.0)");
+}
+
+int main(int argc, char *argv[]) {
+    FILE *out = stdout;
+    if (argc > 1 && !(out = fopen(argv[1], "w"))) { perror(argv[1]); return 1; }
+
+    srand(42);
+    random_points(world.obstacles, 100);
+    random_points(world.targets, MAX_TARGETS);
+
+    char log_path[] = "/tmp/bench_log_XXXXXX";
+    int fd = mkstemp(log_path);
+    if (fd == -1) { perror("mkstemp"); return 1; }
+    close(fd);
+    world.log_file = log_path;
+
+    bench_begin(out);
+
+    static const int obstacle_counts[] = { 0, 1, 5, MAX_OBSTACLES, 50, 100 };
+    for (size_t i = 0; i < sizeof(obstacle_counts) / sizeof(obstacle_counts[0]); i++) {
+        world.n_obs = obstacle_counts[i];
+        bench_run("calc_repulsion", world.n_obs, case_repulsion, &world);
+    }
+
+    bench_run("encode_world_state", MAX_OBSTACLES + MAX_TARGETS, case_encode, &world);
+    // Parse a fixed message, independent of what the encode case left behind
+    encode_world_state(world.msg, DEFAULT_WIDTH, DEFAULT_HEIGHT, 1.0f, -1.0f, world.obstacles, world.targets);
+    bench_run("parse_world_state", MAX_OBSTACLES + MAX_TARGETS, case_parse, &world);
+    bench_run("check_collisions", MAX_OBSTACLES + MAX_TARGETS, case_collisions, &world);
+    bench_run("integrate_step", -1, case_integrate, &world);
+
+    bench_run("log_message", -1, case_log, &world);
+    unlink(log_path);
+
+    bench_end();
+    if (out != stdout) fclose(out);
+    return 0;
+}
@@ -25,11 +25,14 @@
 #define DEFAULT_T 0.1f
 #define DEFAULT_ETA 10.0f
 #define DEFAULT_RHO 5.0f
+#define DEFAULT_AUTOPILOT 0
+#define DEFAULT_AUTO_SPEED 5.0f
 
 // Game Rules
 #define MAX_OBSTACLES 10
 #define MAX_TARGETS 5
 #define COLLISION_DIST 2.0f 
+#define OBSTACLE_HIT_DIST 1.0f
 
 // Log Files  
 #define LOG_INPUT "logs/input.log"
@@ -40,6 +43,13 @@
 
 #define BUF_SIZE 1024 
 
+// Startup handshake: env var holding the readiness pipe fd, and how long the
+// server waits for all children before starting anyway (checking for dead
+// children every READY_POLL_MS)
+#define ENV_READY_FD "DRONE_READY_FD"
+#define READY_TIMEOUT_MS 1000
+#define READY_POLL_MS 10
+
 typedef struct { int x; int y; } Point;
 
 
@@ -78,6 +88,20 @@ static inline void register_process(const char *name) {
     close(fd);
 }
 
+// Helper to tell the server this process finished initialising.
+// Writes "Name PID" to the readiness pipe (atomic: shorter than PIPE_BUF).
+static inline void notify_ready(const char *name) {
+    char *env = getenv(ENV_READY_FD);
+    if (!env) return;
+    int fd = atoi(env);
+
+    char buffer[64];
+    int len = snprintf(buffer, sizeof(buffer), "%s %d\n", name, getpid());
+    write(fd, buffer, len);
+    close(fd);
+    unsetenv(ENV_READY_FD);
+}
+
 // Watchdog Status Reporting
 static char PROC_NAME[32];
 static char CURRENT_STATUS[64] = "Initializing"; 
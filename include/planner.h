@@ -0,0 +1,50 @@
+#ifndef PLANNER_H
+#define PLANNER_H
+
+#include "common.h"
+
+// Cost of a blocked / unreachable cell
+#define PLANNER_INF 1e30f
+
+// Cells kept free around each obstacle when routing
+#define PLANNER_CLEARANCE 1
+
+// Cell state flags
+#define CELL_BLOCKED 0x1
+#define CELL_TARGET  0x2
+
+// Incremental distance field over the world grid.
+// Every cell holds its path cost to the nearest target. When obstacles or
+// targets change, only the affected cells are repaired (LPA* / D* Lite with
+// the drone cell as the start and all targets as goals) instead of
+// recomputing the whole grid.
+typedef struct {
+    int w, h;
+    int clearance;          // Cells blocked around each obstacle
+    float *g;               // Current cost-to-target estimate
+    float *rhs;             // One-step lookahead cost
+    unsigned char *state;   // CELL_BLOCKED / CELL_TARGET flags per cell
+    unsigned char *scratch; // Next state, built by planner_set_world()
+    int *heap;              // Binary min-heap of cell indices
+    int *heap_pos;          // Position of each cell in heap (-1 if absent)
+    float *key;             // Heap key of each queued cell
+    int heap_size;
+    long expanded;          // Cells expanded since creation (statistics)
+} Planner;
+
+Planner *planner_create(int w, int h, int clearance);
+void planner_destroy(Planner *p);
+
+// Replace the obstacle and target sets. Cells whose state changed are
+// queued for repair; nothing is searched until planner_next_step().
+void planner_set_world(Planner *p, const Point *obstacles, int n_obs,
+                       const Point *targets, int n_tar);
+
+// Repair the field around (sx, sy) and return the next cell to move to.
+// Returns 0 on success, -1 if no target is reachable.
+int planner_next_step(Planner *p, int sx, int sy, Point *next);
+
+// Cost from (x, y) to the nearest target (PLANNER_INF if unknown/unreachable).
+float planner_cost(const Planner *p, int x, int y);
+
+#endif
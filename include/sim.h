@@ -0,0 +1,44 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include "common.h"
+
+// Simulation core shared by the processes (built as src/common/libsim.a).
+// Everything here works on explicit arguments instead of process globals,
+// so it can be linked into the processes and into the benchmarks alike.
+
+// --- world.c: Server <-> Drone message ---
+
+// Packs Window Size (W), User Force (F), Obstacles (O) and Targets (T) into
+// "W:w,h|F:fx,fy|O:x,y;...|T:x,y;...\n". msg must hold BUF_SIZE bytes.
+// Returns the message length.
+int encode_world_state(char *msg, int w, int h, float fx, float fy,
+                       const Point *obstacles, const Point *targets);
+
+// Decodes a message built by encode_world_state(). w/h/fx/fy are only
+// updated when present; obstacles/targets (MAX_* entries) are replaced.
+void parse_world_state(const char *buf, int *w, int *h, float *fx, float *fy,
+                       Point *obstacles, Point *targets);
+
+// --- physics.c: Drone dynamics ---
+
+// Artificial Potential Field repulsion from the walls of a w x h world and
+// from the first n_obs obstacles (entries with x == 0 are empty).
+void calc_repulsion(float x, float y, int w, int h,
+                    const Point *obstacles, int n_obs,
+                    float eta, float rho, float *rx, float *ry);
+
+// One step of the F = M*a + K*v integrator for a single axis.
+// Returns the next position given the current and previous ones.
+float integrate_step(float force, float curr, float prev, float M, float K, float T);
+
+// --- collision.c: Game rules ---
+
+// Swept collision test along the segment (x0,y0) -> (x1,y1) against
+// MAX_TARGETS targets and MAX_OBSTACLES obstacles. Collected targets are
+// cleared; counters are incremented and every event is logged to LOG_GAME.
+void check_collisions(Point *targets, const Point *obstacles,
+                      float x0, float y0, float x1, float y1,
+                      int *targets_collected, int *obstacles_hit);
+
+#endif
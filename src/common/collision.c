@@ -0,0 +1,51 @@
+#include "sim.h"
+
+// FUNCTION: segment_hits_circle
+// LOGIC: Finds the point of segment A->B closest to centre C and checks whether
+//        it lies within radius r (squared distances, no sqrt).
+// REASON: Tests the whole path travelled during one tick, not only its end point.
+static inline int segment_hits_circle(float ax, float ay, float bx, float by,
+                                      float cx, float cy, float r) {
+    float sx = bx - ax, sy = by - ay;
+    float len2 = sx*sx + sy*sy;
+    float t = 0.0f;
+    if (len2 > 0.0f) {
+        t = ((cx - ax)*sx + (cy - ay)*sy) / len2;
+        if (t < 0.0f) t = 0.0f; else if (t > 1.0f) t = 1.0f;
+    }
+    float dx = ax + t*sx - cx, dy = ay + t*sy - cy;
+    return dx*dx + dy*dy < r*r;
+}
+
+// FUNCTION: check_collisions
+// LOGIC: Sweeps the segment from the previous to the current drone position
+//        against every target (radius COLLISION_DIST) and obstacle (radius
+//        OBSTACLE_HIT_DIST) in one pass.
+// REASON: A fast drone or a large T can jump over an object between two
+//         samples; the swept test still catches it. Obstacle hits are counted
+//         only when entering, so hovering next to one is a single event.
+void check_collisions(Point *targets, const Point *obstacles,
+                      float x0, float y0, float x1, float y1,
+                      int *targets_collected, int *obstacles_hit) {
+    for(int i=0; i<MAX_TARGETS; i++) {
+        if(targets[i].x == 0) continue;
+        if(segment_hits_circle(x0, y0, x1, y1, targets[i].x, targets[i].y, COLLISION_DIST)) {
+            (*targets_collected)++; 
+            targets[i].x = 0; targets[i].y = 0; 
+            char msg[64];
+            snprintf(msg, sizeof(msg), "SCORE! Target Collected. Total: %d", *targets_collected);
+            log_message(LOG_GAME, msg);
+        }
+    }
+    for(int i=0; i<MAX_OBSTACLES; i++) {
+        if(obstacles[i].x == 0) continue;
+        float dx = x0 - obstacles[i].x, dy = y0 - obstacles[i].y;
+        if(dx*dx + dy*dy < OBSTACLE_HIT_DIST*OBSTACLE_HIT_DIST) continue;
+        if(segment_hits_circle(x0, y0, x1, y1, obstacles[i].x, obstacles[i].y, OBSTACLE_HIT_DIST)) {
+            (*obstacles_hit)++;
+            char msg[64];
+            snprintf(msg, sizeof(msg), "CRASH! Obstacle Hit at (%d,%d). Total: %d", obstacles[i].x, obstacles[i].y, *obstacles_hit);
+            log_message(LOG_GAME, msg);
+        }
+    }
+}
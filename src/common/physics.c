@@ -0,0 +1,55 @@
+#include "sim.h"
+
+// FUNCTION: calc_repulsion
+// LOGIC: Implements the Artificial Potential Field method.
+//        It calculates the distance to walls/obstacles. If dist < RHO, 
+//        it applies a repulsive force inversely proportional to distance.
+void calc_repulsion(float x, float y, int w, int h,
+                    const Point *obstacles, int n_obs,
+                    float eta, float rho, float *rx, float *ry) {
+    *rx = 0; *ry = 0;
+    float dist;
+
+    // ---  WALL REPULSION ---
+    // The drone pushes away from the borders if it gets too close.
+    
+    // Left Wall
+    dist = (x < 0.1f) ? 0.1f : x;
+    if (dist < rho) *rx += eta * pow((1.0/dist - 1.0/rho), 2);
+    
+    // Right Wall
+    dist = w - x; 
+    if (dist < 0.1f) dist = 0.1f;
+    if (dist < rho) *rx -= eta * pow((1.0/dist - 1.0/rho), 2);
+    
+    // Top Wall
+    dist = (y < 0.1f) ? 0.1f : y;
+    if (dist < rho) *ry += eta * pow((1.0/dist - 1.0/rho), 2);
+    
+    // Bottom Wall
+    dist = h - y; 
+    if (dist < 0.1f) dist = 0.1f;
+    if (dist < rho) *ry -= eta * pow((1.0/dist - 1.0/rho), 2);
+
+    // --- OBSTACLE REPULSION ---
+    for(int i=0; i<n_obs; i++) {
+        if(obstacles[i].x == 0) continue;
+        float dx = x - obstacles[i].x;
+        float dy = y - obstacles[i].y;
+        dist = sqrt(dx*dx + dy*dy);
+        if(dist < 0.1f) dist = 0.1f;
+        if(dist < rho) {
+            float mag = eta * pow((1.0/dist - 1.0/rho), 2);
+            *rx += mag * (dx/dist); *ry += mag * (dy/dist);
+        }
+    }
+}
+
+// FUNCTION: integrate_step
+// LOGIC: Discretised F = M*a + K*v (Euler), solved for the next position:
+//        x_next = (F + (2a + b)*x - a*x_prev) / (a + b),  a = M/T^2, b = K/T
+float integrate_step(float force, float curr, float prev, float M, float K, float T) {
+    float a = M / (T * T);
+    float b = K / T;
+    return (force + (2 * a + b) * curr - a * prev) / (a + b);
+}
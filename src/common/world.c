@@ -0,0 +1,52 @@
+#include "sim.h"
+
+// FUNCTION: encode_world_state
+// LOGIC: Packs current Window Size (W), User Force (F), Obstacles (O), and Targets (T)
+//        into a single string to send via pipe to the Drone process.
+int encode_world_state(char *msg, int w, int h, float fx, float fy,
+                       const Point *obstacles, const Point *targets) {
+    int offset = 0;
+    offset += sprintf(msg + offset, "W:%d,%d|F:%.2f,%.2f|", w, h, fx, fy);
+    offset += sprintf(msg + offset, "O:");
+    for(int i=0; i<MAX_OBSTACLES; i++) if(obstacles[i].x != 0) offset += sprintf(msg + offset, "%d,%d;", obstacles[i].x, obstacles[i].y);
+    msg[offset-1] = '|'; 
+    offset += sprintf(msg + offset, "T:");
+    for(int i=0; i<MAX_TARGETS; i++) if(targets[i].x != 0) offset += sprintf(msg + offset, "%d,%d;", targets[i].x, targets[i].y);
+    offset += sprintf(msg + offset, "\n");
+    return offset;
+}
+
+// FUNCTION: parse_world_state
+// LOGIC: Decodes the string sent by the Server (e.g., "W:100,30|F:1.0,0.0|O:...")
+// REASON: Updates the local view of window size, User Command Forces,
+//         obstacles and targets.
+void parse_world_state(const char *buf, int *w, int *h, float *fx, float *fy,
+                       Point *obstacles, Point *targets) {
+    const char *w_ptr = strstr(buf, "W:");
+    if(w_ptr) sscanf(w_ptr, "W:%d,%d", w, h);
+
+    const char *f_ptr = strstr(buf, "F:");
+    if(f_ptr) sscanf(f_ptr, "F:%f,%f", fx, fy);
+    
+    memset(obstacles, 0, MAX_OBSTACLES * sizeof(Point));
+    const char *o_ptr = strstr(buf, "O:");
+    if(o_ptr) {
+        o_ptr += 2;
+        int i=0, ox, oy, off;
+        while(sscanf(o_ptr, "%d,%d%n", &ox, &oy, &off) == 2 && i < MAX_OBSTACLES) {
+            obstacles[i].x = ox; obstacles[i].y = oy;
+            i++; o_ptr += off; if(*o_ptr == ';') o_ptr++; else break;
+        }
+    }
+
+    memset(targets, 0, MAX_TARGETS * sizeof(Point));
+    const char *t_ptr = strstr(buf, "T:");
+    if(t_ptr) {
+        t_ptr += 2;
+        int i=0, tx, ty, off;
+        while(sscanf(t_ptr, "%d,%d%n", &tx, &ty, &off) == 2 && i < MAX_TARGETS) {
+            targets[i].x = tx; targets[i].y = ty;
+            i++; t_ptr += off; if(*t_ptr == ';') t_ptr++; else break;
+        }
+    }
+}
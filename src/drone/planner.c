@@ -0,0 +1,232 @@
+#include "planner.h"
+
+// 8-connected grid moves
+static const int MOVE_DX[8] = { 1, -1, 0,  0, 1,  1, -1, -1 };
+static const int MOVE_DY[8] = { 0,  0, 1, -1, 1, -1,  1, -1 };
+static const float MOVE_COST[8] = { 1.0f, 1.0f, 1.0f, 1.0f,
+                                    1.41421356f, 1.41421356f, 1.41421356f, 1.41421356f };
+
+static inline int is_blocked(const Planner *p, int x, int y) {
+    if (x < 0 || y < 0 || x >= p->w || y >= p->h) return 1;
+    return p->state[y * p->w + x] & CELL_BLOCKED;
+}
+
+// Cost of moving from (x,y) in direction d. Diagonals may not cut the corner
+// of a blocked cell, so a diagonal edge also depends on its two side cells.
+static float edge_cost(const Planner *p, int x, int y, int d) {
+    int nx = x + MOVE_DX[d], ny = y + MOVE_DY[d];
+    if (is_blocked(p, x, y) || is_blocked(p, nx, ny)) return PLANNER_INF;
+    if (d >= 4 && (is_blocked(p, nx, y) || is_blocked(p, x, ny))) return PLANNER_INF;
+    return MOVE_COST[d];
+}
+
+// --- BINARY HEAP (keyed by min(g, rhs)) ---
+
+static void heap_swap(Planner *p, int a, int b) {
+    int ca = p->heap[a], cb = p->heap[b];
+    p->heap[a] = cb; p->heap_pos[cb] = a;
+    p->heap[b] = ca; p->heap_pos[ca] = b;
+}
+
+static void heap_up(Planner *p, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (p->key[p->heap[parent]] <= p->key[p->heap[i]]) break;
+        heap_swap(p, i, parent);
+        i = parent;
+    }
+}
+
+static void heap_down(Planner *p, int i) {
+    while (1) {
+        int l = 2 * i + 1, r = l + 1, m = i;
+        if (l < p->heap_size && p->key[p->heap[l]] < p->key[p->heap[m]]) m = l;
+        if (r < p->heap_size && p->key[p->heap[r]] < p->key[p->heap[m]]) m = r;
+        if (m == i) break;
+        heap_swap(p, i, m);
+        i = m;
+    }
+}
+
+static void heap_push(Planner *p, int cell, float key) {
+    p->key[cell] = key;
+    p->heap[p->heap_size] = cell;
+    p->heap_pos[cell] = p->heap_size;
+    heap_up(p, p->heap_size++);
+}
+
+static void heap_remove(Planner *p, int cell) {
+    int i = p->heap_pos[cell];
+    if (i < 0) return;
+    p->heap_pos[cell] = -1;
+    if (--p->heap_size == i) return;
+    int moved = p->heap[p->heap_size];
+    p->heap[i] = moved;
+    p->heap_pos[moved] = i;
+    heap_up(p, i);
+    heap_down(p, p->heap_pos[moved]);
+}
+
+static int heap_pop(Planner *p) {
+    int cell = p->heap[0];
+    heap_remove(p, cell);
+    return cell;
+}
+
+// --- LPA* CORE ---
+
+// FUNCTION: update_vertex
+// LOGIC: Recomputes rhs (best neighbour g + edge cost) and re-queues the
+//        cell if it became inconsistent (g != rhs).
+static void update_vertex(Planner *p, int cell) {
+    int x = cell % p->w, y = cell / p->w;
+    if (p->state[cell] & CELL_TARGET) {
+        p->rhs[cell] = 0.0f;
+    } else {
+        float best = PLANNER_INF;
+        for (int d = 0; d < 8; d++) {
+            float c = edge_cost(p, x, y, d);
+            if (c >= PLANNER_INF) continue;
+            float v = p->g[(y + MOVE_DY[d]) * p->w + x + MOVE_DX[d]] + c;
+            if (v < best) best = v;
+        }
+        p->rhs[cell] = best;
+    }
+    heap_remove(p, cell);
+    if (p->g[cell] != p->rhs[cell])
+        heap_push(p, cell, fminf(p->g[cell], p->rhs[cell]));
+}
+
+static void update_neighbours(Planner *p, int cell) {
+    int x = cell % p->w, y = cell / p->w;
+    for (int d = 0; d < 8; d++) {
+        int nx = x + MOVE_DX[d], ny = y + MOVE_DY[d];
+        if (nx < 0 || ny < 0 || nx >= p->w || ny >= p->h) continue;
+        update_vertex(p, ny * p->w + nx);
+    }
+}
+
+// FUNCTION: compute_field
+// LOGIC: Expands inconsistent cells in key order until the start cell is
+//        consistent and nothing cheaper is left in the queue.
+// REASON: Cells farther from the targets than the drone are left queued,
+//         so a replan only touches the region the change actually affects.
+static void compute_field(Planner *p, int start) {
+    while (p->heap_size > 0) {
+        float start_key = fminf(p->g[start], p->rhs[start]);
+        if (p->key[p->heap[0]] >= start_key && p->g[start] == p->rhs[start]) break;
+
+        int u = heap_pop(p);
+        p->expanded++;
+        if (p->g[u] > p->rhs[u]) {
+            p->g[u] = p->rhs[u];
+        } else {
+            p->g[u] = PLANNER_INF;
+            update_vertex(p, u);
+        }
+        update_neighbours(p, u);
+    }
+}
+
+// --- PUBLIC API ---
+
+Planner *planner_create(int w, int h, int clearance) {
+    Planner *p = calloc(1, sizeof(Planner));
+    if (!p) return NULL;
+    int n = w * h;
+    p->w = w; p->h = h; p->clearance = clearance;
+    p->g = malloc(n * sizeof(float));
+    p->rhs = malloc(n * sizeof(float));
+    p->key = malloc(n * sizeof(float));
+    p->heap = malloc(n * sizeof(int));
+    p->heap_pos = malloc(n * sizeof(int));
+    p->state = calloc(n, 1);
+    p->scratch = calloc(n, 1);
+    if (!p->g || !p->rhs || !p->key || !p->heap || !p->heap_pos || !p->state || !p->scratch) {
+        planner_destroy(p);
+        return NULL;
+    }
+    for (int i = 0; i < n; i++) {
+        p->g[i] = PLANNER_INF; p->rhs[i] = PLANNER_INF; p->heap_pos[i] = -1;
+    }
+    // Border cells are walls
+    for (int x = 0; x < w; x++) { p->state[x] = CELL_BLOCKED; p->state[(h-1)*w + x] = CELL_BLOCKED; }
+    for (int y = 0; y < h; y++) { p->state[y*w] = CELL_BLOCKED; p->state[y*w + w-1] = CELL_BLOCKED; }
+    return p;
+}
+
+void planner_destroy(Planner *p) {
+    if (!p) return;
+    free(p->g); free(p->rhs); free(p->key);
+    free(p->heap); free(p->heap_pos);
+    free(p->state); free(p->scratch);
+    free(p);
+}
+
+// FUNCTION: planner_set_world
+// LOGIC: Rasterises obstacles (inflated by 'clearance') and targets into the
+//        scratch grid, then diffs it against the current grid.
+// REASON: Only cells whose state flipped (and their neighbours, whose edge
+//         costs depend on them) are handed to the repair step.
+void planner_set_world(Planner *p, const Point *obstacles, int n_obs,
+                       const Point *targets, int n_tar) {
+    int w = p->w, h = p->h;
+    memset(p->scratch, 0, w * h);
+    for (int x = 0; x < w; x++) { p->scratch[x] = CELL_BLOCKED; p->scratch[(h-1)*w + x] = CELL_BLOCKED; }
+    for (int y = 0; y < h; y++) { p->scratch[y*w] = CELL_BLOCKED; p->scratch[y*w + w-1] = CELL_BLOCKED; }
+
+    for (int i = 0; i < n_obs; i++) {
+        if (obstacles[i].x == 0) continue;
+        for (int dy = -p->clearance; dy <= p->clearance; dy++) {
+            for (int dx = -p->clearance; dx <= p->clearance; dx++) {
+                int x = obstacles[i].x + dx, y = obstacles[i].y + dy;
+                if (x < 0 || y < 0 || x >= w || y >= h) continue;
+                p->scratch[y*w + x] = CELL_BLOCKED;
+            }
+        }
+    }
+    // Targets win over obstacle clearance so they stay reachable
+    for (int i = 0; i < n_tar; i++) {
+        int x = targets[i].x, y = targets[i].y;
+        if (x <= 0 || y <= 0 || x >= w-1 || y >= h-1) continue;
+        p->scratch[y*w + x] = CELL_TARGET;
+    }
+
+    for (int cell = 0; cell < w * h; cell++) {
+        if (p->scratch[cell] == p->state[cell]) continue;
+        p->state[cell] = p->scratch[cell];
+        update_vertex(p, cell);
+        update_neighbours(p, cell);
+    }
+}
+
+int planner_next_step(Planner *p, int sx, int sy, Point *next) {
+    if (sx < 0) sx = 0;
+    if (sx >= p->w) sx = p->w - 1;
+    if (sy < 0) sy = 0;
+    if (sy >= p->h) sy = p->h - 1;
+    int start = sy * p->w + sx;
+
+    compute_field(p, start);
+
+    if (p->state[start] & CELL_TARGET) {
+        next->x = sx; next->y = sy;
+        return 0;
+    }
+
+    // The drone may sit inside an obstacle's clearance, so pick the best
+    // neighbour on geometry alone rather than through edge_cost().
+    float best = PLANNER_INF;
+    for (int d = 0; d < 8; d++) {
+        int nx = sx + MOVE_DX[d], ny = sy + MOVE_DY[d];
+        if (is_blocked(p, nx, ny)) continue;
+        float v = p->g[ny * p->w + nx] + MOVE_COST[d];
+        if (v < best) { best = v; next->x = nx; next->y = ny; }
+    }
+    return (best < PLANNER_INF) ? 0 : -1;
+}
+
+float planner_cost(const Planner *p, int x, int y) {
+    if (x < 0 || y < 0 || x >= p->w || y >= p->h) return PLANNER_INF;
+    return p->g[y * p->w + x];
+}
@@ -1,4 +1,6 @@
 #include "common.h"
+#include "planner.h"
+#include "sim.h"
 
 // --- KEY VARIABLES FOR PHYSICS ---
 // M: Mass of the drone (Inertia)
@@ -14,7 +16,15 @@ float T = DEFAULT_T;
 float ETA = DEFAULT_ETA;
 float RHO = DEFAULT_RHO;
 
+// --- KEY VARIABLES FOR AUTOPILOT ---
+// AUTOPILOT: 1 = fly to targets on its own, 0 = manual control (F_cmd)
+// AUTO_SPEED: Cruise speed (cells per second) the autopilot aims for
+int AUTOPILOT = DEFAULT_AUTOPILOT;
+float AUTO_SPEED = DEFAULT_AUTO_SPEED;
+
 Point obstacles[MAX_OBSTACLES];
+Point targets[MAX_TARGETS];
+Planner *planner = NULL;
 int current_w = DEFAULT_WIDTH;
 int current_h = DEFAULT_HEIGHT;
 
@@ -33,74 +43,43 @@ void load_params() {
             if (strncmp(line, "T=", 2) == 0) T = atof(line+2);
             if (strncmp(line, "ETA=", 4) == 0) ETA = atof(line+4);
             if (strncmp(line, "RHO=", 4) == 0) RHO = atof(line+4);
+            if (strncmp(line, "AUTOPILOT=", 10) == 0) AUTOPILOT = atoi(line+10);
+            if (strncmp(line, "AUTO_SPEED=", 11) == 0) AUTO_SPEED = atof(line+11);
         }
         fclose(f);
     }
 }
 
-// FUNCTION: parse_world_state
-// LOGIC: Decodes the string sent by the Server (e.g., "W:100,30|F:1.0,0.0|O:...")
-// REASON: Updates the local view of window size and User Command Forces.
-void parse_world_state(char *buf, float *fx, float *fy) {
-    char *w_ptr = strstr(buf, "W:");
-    if(w_ptr) sscanf(w_ptr, "W:%d,%d", &current_w, &current_h);
-
-    char *f_ptr = strstr(buf, "F:");
-    if(f_ptr) sscanf(f_ptr, "F:%f,%f", fx, fy);
-    
-    memset(obstacles, 0, sizeof(obstacles));
-    char *o_ptr = strstr(buf, "O:");
-    if(o_ptr) {
-        o_ptr += 2;
-        int i=0, ox, oy, off;
-        while(sscanf(o_ptr, "%d,%d%n", &ox, &oy, &off) == 2 && i < MAX_OBSTACLES) {
-            obstacles[i].x = ox; obstacles[i].y = oy;
-            i++; o_ptr += off; if(*o_ptr == ';') o_ptr++; else break;
-        }
+// FUNCTION: calc_autopilot
+// LOGIC: Asks the incremental planner for the next grid cell on the shortest
+//        path to the nearest target, then computes the force that brings the
+//        drone to AUTO_SPEED towards that cell within one time step (velocity
+//        from the current and previous position).
+// REASON: The planner only repairs the part of its distance field touched by
+//         new obstacles/targets, so replanning every cycle stays cheap.
+void calc_autopilot(float x, float y, float x_last, float y_last, float *ax, float *ay) {
+    *ax = 0; *ay = 0;
+
+    if (!planner || planner->w != current_w || planner->h != current_h) {
+        planner_destroy(planner);
+        planner = planner_create(current_w, current_h, PLANNER_CLEARANCE);
+        if (!planner) return;
     }
-}
-
-// FUNCTION: calc_repulsion
-// LOGIC: Implements the Artificial Potential Field method.
-//        It calculates the distance to walls/obstacles. If dist < RHO, 
-//        it applies a repulsive force inversely proportional to distance.
-void calc_repulsion(float x, float y, float *rx, float *ry) {
-    *rx = 0; *ry = 0;
-    float dist;
-
-    // ---  WALL REPULSION ---
-    // The drone pushes away from the borders if it gets too close.
-    
-    // Left Wall
-    dist = (x < 0.1f) ? 0.1f : x;
-    if (dist < RHO) *rx += ETA * pow((1.0/dist - 1.0/RHO), 2);
-    
-    // Right Wall
-    dist = current_w - x; 
-    if (dist < 0.1f) dist = 0.1f;
-    if (dist < RHO) *rx -= ETA * pow((1.0/dist - 1.0/RHO), 2);
-    
-    // Top Wall
-    dist = (y < 0.1f) ? 0.1f : y;
-    if (dist < RHO) *ry += ETA * pow((1.0/dist - 1.0/RHO), 2);
-    
-    // Bottom Wall
-    dist = current_h - y; 
-    if (dist < 0.1f) dist = 0.1f;
-    if (dist < RHO) *ry -= ETA * pow((1.0/dist - 1.0/RHO), 2);
-
-    // --- OBSTACLE REPULSION ---
-    for(int i=0; i<MAX_OBSTACLES; i++) {
-        if(obstacles[i].x == 0) continue;
-        float dx = x - obstacles[i].x;
-        float dy = y - obstacles[i].y;
-        dist = sqrt(dx*dx + dy*dy);
-        if(dist < 0.1f) dist = 0.1f;
-        if(dist < RHO) {
-            float mag = ETA * pow((1.0/dist - 1.0/RHO), 2);
-            *rx += mag * (dx/dist); *ry += mag * (dy/dist);
-        }
+    planner_set_world(planner, obstacles, MAX_OBSTACLES, targets, MAX_TARGETS);
+
+    Point next;
+    float vx_des = 0, vy_des = 0;
+    if (planner_next_step(planner, (int)roundf(x), (int)roundf(y), &next) == 0) {
+        float dx = next.x - x, dy = next.y - y;
+        float dist = sqrt(dx*dx + dy*dy);
+        if (dist > 0.01f) { vx_des = AUTO_SPEED * dx / dist; vy_des = AUTO_SPEED * dy / dist; }
     }
+
+    // Force that reaches the desired velocity in one step of the integrator
+    // below: F = K*v_des + M*(v_des - v)/T  (no target reachable -> brake)
+    float vx = (x - x_last) / T, vy = (y - y_last) / T;
+    *ax = K * vx_des + M * (vx_des - vx) / T;
+    *ay = K * vy_des + M * (vy_des - vy) / T;
 }
 
 int main(void) {
@@ -113,11 +92,13 @@ int main(void) {
 
     float F_cmd_x = 0, F_cmd_y = 0;
     float F_rep_x = 0, F_rep_y = 0;
+    float F_auto_x = 0, F_auto_y = 0;
     int iter = 0;
 
     fcntl(STDIN_FILENO, F_SETFL, O_NONBLOCK);
     char buf[BUF_SIZE];
     struct timespec ts = {0, (long)(T * 1e9)};
+    notify_ready("Drone");
 
     while (1) {
         set_status("Reading Input");
@@ -126,7 +107,7 @@ int main(void) {
             buf[n] = 0;
             char *start = strrchr(buf, 'W');
             if (!start) start = strrchr(buf, 'F');
-            if (start) parse_world_state(start, &F_cmd_x, &F_cmd_y);
+            if (start) parse_world_state(start, &current_w, &current_h, &F_cmd_x, &F_cmd_y, obstacles, targets);
         }
 
         if (++iter % 20 == 0) {
@@ -135,21 +116,24 @@ int main(void) {
         }
 
         set_status("Physics Calculation");
-        calc_repulsion(x_curr, y_curr, &F_rep_x, &F_rep_y);
+        calc_repulsion(x_curr, y_curr, current_w, current_h, obstacles, MAX_OBSTACLES, ETA, RHO, &F_rep_x, &F_rep_y);
         
         // --- ASSIGNMENT 1 FIX: MANUAL CONTROL ONLY ---
         // Originally, there was an "Attraction Force" pulling the drone to targets.
         // That was REMOVED to ensure the drone only moves when buttons are pressed (F_cmd)
         // or when pushed by walls (F_rep).
-        float F_total_x = F_cmd_x + F_rep_x;
-        float F_total_y = F_cmd_y + F_rep_y;
+        // In AUTOPILOT mode the planner's force replaces the user's command.
+        if (AUTOPILOT) {
+            set_status("Path Planning");
+            calc_autopilot(x_curr, y_curr, x_prev, y_prev, &F_auto_x, &F_auto_y);
+        }
+        float F_total_x = (AUTOPILOT ? F_auto_x : F_cmd_x) + F_rep_x;
+        float F_total_y = (AUTOPILOT ? F_auto_y : F_cmd_y) + F_rep_y;
         
         // --- PHYSICS ENGINE (Euler Integration) ---
         // Calculates the next position based on Force, Mass, and Friction.
-        float a = M / (T * T);
-        float b = K / T;
-        float next_x = (F_total_x + (2 * a + b) * x_curr - a * x_prev) / (a + b);
-        float next_y = (F_total_y + (2 * a + b) * y_curr - a * y_prev) / (a + b);
+        float next_x = integrate_step(F_total_x, x_curr, x_prev, M, K, T);
+        float next_y = integrate_step(F_total_y, y_curr, y_prev, M, K, T);
 
         x_prev = x_curr; y_prev = y_curr;
         x_curr = next_x; y_curr = next_y;
@@ -164,7 +148,7 @@ int main(void) {
         fflush(stdout);
         
         char log_buf[256];
-        snprintf(log_buf, sizeof(log_buf), "POS:(%.2f,%.2f) CMD:(%.1f,%.1f)", x_curr, y_curr, F_cmd_x, F_cmd_y);
+        snprintf(log_buf, sizeof(log_buf), "POS:(%.2f,%.2f) CMD:(%.1f,%.1f)%s", x_curr, y_curr, F_cmd_x, F_cmd_y, AUTOPILOT ? " AUTO" : "");
         log_message(LOG_DRONE, log_buf);
 
         set_status("Sleeping");
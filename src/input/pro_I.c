@@ -29,6 +29,7 @@ int main() {
     
     tcflush(STDIN_FILENO, TCIFLUSH);
     printf("0.0,0.0\n"); fflush(stdout);
+    notify_ready("Input");
 
     while (1) {
         set_status("Waiting Keypress");
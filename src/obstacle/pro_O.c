@@ -3,6 +3,7 @@
 int main(int argc, char *argv[]) {
     register_process("Obstacles");
     setup_watchdog_monitor("Obstacles");
+    notify_ready("Obstacles");
 
     srand(time(NULL) ^ getpid());
     int max_w = DEFAULT_WIDTH; 
@@ -1,6 +1,10 @@
 #include "common.h"
+#include "sim.h"
 #include <ncurses.h>
 #include <time.h> 
+#include <pthread.h>
+
+#define RENDER_FPS 30
 
 // Pipes for IPC
 int pipe_input_to_server[2];
@@ -8,17 +12,20 @@ int pipe_server_to_drone[2];
 int pipe_drone_to_server[2];
 int pipe_obstacle_to_server[2];
 int pipe_target_to_server[2];
+int pipe_ready[2]; // Children -> Server readiness reports (startup handshake)
 
 pid_t pid_input = -1, pid_drone = -1, pid_obs = -1, pid_tar = -1, pid_wd = -1;
 
 Point obstacles[MAX_OBSTACLES];
 Point targets[MAX_TARGETS];
 float drone_x, drone_y;
+// Terminal size: written by the render thread, read by the I/O thread (atomics)
 int screen_w = DEFAULT_WIDTH;
 int screen_h = DEFAULT_HEIGHT;
 
 // Scoring
 int targets_collected = 0;
+int obstacles_hit = 0;
 float total_distance = 0.0f;
 time_t start_time;
 int final_score = 0;
@@ -26,6 +33,53 @@ int final_score = 0;
 int obs_idx = 0;
 int tar_idx = 0;
 
+// --- WORLD SNAPSHOTS (I/O thread -> render thread) ---
+// Immutable copy of everything draw_ui() needs.
+typedef struct {
+    Point obstacles[MAX_OBSTACLES];
+    Point targets[MAX_TARGETS];
+    float drone_x, drone_y;
+    float force_x, force_y;
+    int final_score, targets_collected, obstacles_hit;
+    float total_distance;
+} WorldSnapshot;
+
+// Triple buffer: the writer owns snap_back, the reader owns snap_front and
+// snap_middle is swapped atomically between them. SNAP_NEW marks a middle
+// slot the reader has not picked up yet. Neither side ever waits.
+#define SNAP_IDX 0x3
+#define SNAP_NEW 0x4
+WorldSnapshot snap_buf[3];
+int snap_back = 0;
+int snap_middle = 1;
+int snap_front = 2;
+int running = 1; // Cleared by the I/O thread to stop the render thread
+
+// Startup tracking (ms since server start, < 0 = not yet)
+typedef struct {
+    const char *name;   // Name the child passes to notify_ready()
+    pid_t *pid;         // Global holding the child's PID (-1 once reaped)
+    double spawn_ms;
+    double ready_ms;
+    double first_tick_ms;
+} StartupInfo;
+
+enum { SU_WATCHDOG, SU_INPUT, SU_DRONE, SU_OBSTACLES, SU_TARGETS, SU_COUNT };
+StartupInfo startup[SU_COUNT] = {
+    { "Watchdog",  &pid_wd,    -1, -1, -1 },
+    { "Input",     &pid_input, -1, -1, -1 },
+    { "Drone",     &pid_drone, -1, -1, -1 },
+    { "Obstacles", &pid_obs,   -1, -1, -1 },
+    { "Targets",   &pid_tar,   -1, -1, -1 },
+};
+struct timespec boot_ts;
+
+double elapsed_ms() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - boot_ts.tv_sec) * 1e3 + (now.tv_nsec - boot_ts.tv_nsec) / 1e6;
+}
+
 void reset_logs() {
     FILE *f;
     f = fopen(LOG_INPUT, "w"); if(f) { fprintf(f, "--- LIVE INPUT MONITOR ---\n"); fclose(f); }
@@ -57,24 +111,91 @@ void spawn_keyboard_guide() {
     }
 }
 
-// FUNCTION: check_collisions
-// LOGIC: Calculates Euclidean distance between drone and targets.
-//        If distance < 2.0, it counts as a collection.
-void check_collisions() {
-    float radius = 2.0f;
-    for(int i=0; i<MAX_TARGETS; i++) {
-        if(targets[i].x == 0) continue;
-        float dx = drone_x - targets[i].x;
-        float dy = drone_y - targets[i].y;
-        float dist = sqrt(dx*dx + dy*dy);
-        if(dist < radius) {
-            targets_collected++; 
-            targets[i].x = 0; targets[i].y = 0; 
-            char msg[64];
-            snprintf(msg, sizeof(msg), "SCORE! Target Collected. Total: %d", targets_collected);
-            log_message(LOG_GAME, msg);
+// FUNCTION: read_ready_reports
+// LOGIC: Reads "Name PID" lines from the readiness pipe and stamps the
+//        ready time of the matching component.
+void read_ready_reports() {
+    static char pending[256];
+    static int len = 0;
+    if (len == sizeof(pending) - 1) len = 0; // Garbage without newline
+    int n = read(pipe_ready[0], pending + len, sizeof(pending) - 1 - len);
+    if (n == 0) { close(pipe_ready[0]); pipe_ready[0] = -1; return; } // All writers gone
+    if (n < 0) return;
+    len += n; pending[len] = 0;
+
+    char *line = pending, *nl;
+    while ((nl = strchr(line, '\n'))) {
+        *nl = 0;
+        char name[32]; int pid;
+        if (sscanf(line, "%31s %d", name, &pid) == 2) {
+            for (int i = 0; i < SU_COUNT; i++) {
+                if (strcmp(name, startup[i].name) == 0 && startup[i].ready_ms < 0) {
+                    startup[i].ready_ms = elapsed_ms();
+                    char msg[96];
+                    snprintf(msg, sizeof(msg), "STARTUP: %s (PID %d) ready after %.1f ms",
+                             name, pid, startup[i].ready_ms - startup[i].spawn_ms);
+                    log_message(LOG_GAME, msg);
+                }
+            }
         }
+        line = nl + 1;
     }
+    len -= line - pending;
+    memmove(pending, line, len);
+}
+
+// FUNCTION: wait_ready
+// LOGIC: Blocks on the readiness pipe until every component has reported,
+//        died, or READY_TIMEOUT_MS has passed.
+// REASON: Replaces a fixed sleep; startup proceeds the moment children are up.
+//         Waking every READY_POLL_MS to reap children means a failed exec
+//         (e.g. no xterm) does not hold startup for the full timeout.
+void wait_ready() {
+    double deadline = elapsed_ms() + READY_TIMEOUT_MS;
+    while (1) {
+        int missing = 0;
+        for (int i = 0; i < SU_COUNT; i++) {
+            if (startup[i].ready_ms >= 0 || *startup[i].pid <= 0) continue;
+            int st;
+            if (waitpid(*startup[i].pid, &st, WNOHANG) == *startup[i].pid) {
+                *startup[i].pid = -1;
+                char msg[96];
+                snprintf(msg, sizeof(msg), "STARTUP: %s exited before ready, continuing", startup[i].name);
+                log_message(LOG_GAME, msg);
+                continue;
+            }
+            missing++;
+        }
+        if (missing == 0) return;
+
+        double left = deadline - elapsed_ms();
+        if (left <= 0 || pipe_ready[0] < 0) break;
+        if (left > READY_POLL_MS) left = READY_POLL_MS;
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(pipe_ready[0], &fds);
+        struct timeval timeout = { 0, (long)(left * 1000) };
+        int r = select(pipe_ready[0] + 1, &fds, NULL, NULL, &timeout);
+        if (r < 0 && errno != EINTR) break;
+        if (r > 0) read_ready_reports();
+    }
+    for (int i = 0; i < SU_COUNT; i++) {
+        if (startup[i].ready_ms >= 0 || *startup[i].pid <= 0) continue;
+        char msg[96];
+        snprintf(msg, sizeof(msg), "STARTUP: %s not ready after %d ms, continuing", startup[i].name, READY_TIMEOUT_MS);
+        log_message(LOG_GAME, msg);
+    }
+}
+
+// FUNCTION: mark_first_tick
+// LOGIC: Logs time-to-first-tick the first time a component's pipe delivers data.
+void mark_first_tick(int id) {
+    if (startup[id].first_tick_ms >= 0) return;
+    startup[id].first_tick_ms = elapsed_ms();
+    char msg[96];
+    snprintf(msg, sizeof(msg), "STARTUP: %s first tick after %.1f ms",
+             startup[id].name, startup[id].first_tick_ms - startup[id].spawn_ms);
+    log_message(LOG_GAME, msg);
 }
 
 void init_world() {
@@ -99,31 +220,56 @@ void init_ncurses_safe() {
     init_pair(4, COLOR_YELLOW, COLOR_BLACK);  
 }
 
-void draw_ui(float fx, float fy) {
+// FUNCTION: publish_snapshot
+// LOGIC: Copies the live world into the back slot and swaps it into the middle.
+// REASON: Called by the I/O thread only; costs a memcpy and one atomic swap.
+void publish_snapshot(float fx, float fy) {
+    WorldSnapshot *s = &snap_buf[snap_back];
+    memcpy(s->obstacles, obstacles, sizeof(obstacles));
+    memcpy(s->targets, targets, sizeof(targets));
+    s->drone_x = drone_x; s->drone_y = drone_y;
+    s->force_x = fx; s->force_y = fy;
+    s->final_score = final_score;
+    s->targets_collected = targets_collected;
+    s->obstacles_hit = obstacles_hit;
+    s->total_distance = total_distance;
+    snap_back = __atomic_exchange_n(&snap_middle, snap_back | SNAP_NEW, __ATOMIC_ACQ_REL) & SNAP_IDX;
+}
+
+// FUNCTION: acquire_snapshot
+// LOGIC: Takes the middle slot if it holds a newer snapshot, otherwise keeps
+//        the current front one. Called by the render thread only.
+const WorldSnapshot *acquire_snapshot() {
+    if (__atomic_load_n(&snap_middle, __ATOMIC_ACQUIRE) & SNAP_NEW)
+        snap_front = __atomic_exchange_n(&snap_middle, snap_front, __ATOMIC_ACQ_REL) & SNAP_IDX;
+    return &snap_buf[snap_front];
+}
+
+void draw_ui(const WorldSnapshot *s) {
     erase();
     attron(COLOR_PAIR(2));
     for(int x=0; x<screen_w; x++) { mvaddch(0, x, '-'); mvaddch(screen_h-1, x, '-'); }
     for(int y=0; y<screen_h; y++) { mvaddch(y, 0, '|'); mvaddch(y, screen_w-1, '|'); }
-    mvprintw(0, 2, " Drone Sim | SCORE: %d | Targets: %d ", final_score, targets_collected);
-    mvprintw(screen_h-1, 2, " Cmd Force: %.1f, %.1f | Time: %lds | Dist: %.0fm ", fx, fy, time(NULL)-start_time, total_distance);
+    mvprintw(0, 2, " Drone Sim | SCORE: %d | Targets: %d | Hits: %d ", s->final_score, s->targets_collected, s->obstacles_hit);
+    mvprintw(screen_h-1, 2, " Cmd Force: %.1f, %.1f | Time: %lds | Dist: %.0fm ", s->force_x, s->force_y, time(NULL)-start_time, s->total_distance);
     attroff(COLOR_PAIR(2));
 
     attron(COLOR_PAIR(3));
     for (int i = 0; i < MAX_OBSTACLES; ++i) {
-        if(obstacles[i].x > 0 && obstacles[i].x < screen_w && obstacles[i].y > 0 && obstacles[i].y < screen_h)
-            mvaddch(obstacles[i].y, obstacles[i].x, 'O');
+        if(s->obstacles[i].x > 0 && s->obstacles[i].x < screen_w && s->obstacles[i].y > 0 && s->obstacles[i].y < screen_h)
+            mvaddch(s->obstacles[i].y, s->obstacles[i].x, 'O');
     }
     attroff(COLOR_PAIR(3));
     
     attron(COLOR_PAIR(4));
     for (int i = 0; i < MAX_TARGETS; ++i) {
-        if(targets[i].x > 0 && targets[i].x < screen_w && targets[i].y > 0 && targets[i].y < screen_h)
-            mvaddch(targets[i].y, targets[i].x, '1' + i);
+        if(s->targets[i].x > 0 && s->targets[i].x < screen_w && s->targets[i].y > 0 && s->targets[i].y < screen_h)
+            mvaddch(s->targets[i].y, s->targets[i].x, '1' + i);
     }
     attroff(COLOR_PAIR(4));
 
     attron(COLOR_PAIR(1));
-    int dx = (int)drone_x; int dy = (int)drone_y;
+    int dx = (int)s->drone_x; int dy = (int)s->drone_y;
     if (dx < 1) dx = 1; if (dx >= screen_w-1) dx = screen_w-2;
     if (dy < 1) dy = 1; if (dy >= screen_h-1) dy = screen_h-2;
     mvaddch(dy, dx, '+');
@@ -131,20 +277,32 @@ void draw_ui(float fx, float fy) {
     refresh();
 }
 
+// FUNCTION: render_loop
+// LOGIC: Render thread. Draws the latest snapshot at RENDER_FPS and publishes
+//        the terminal size back to the I/O thread. Owns ncurses exclusively.
+// REASON: A slow terminal (refresh()) never delays reading pipes or sending
+//         forces to the Drone; the control loop runs at its own rate.
+void *render_loop(void *arg) {
+    struct timespec frame = {0, 1000000000L / RENDER_FPS};
+    while (__atomic_load_n(&running, __ATOMIC_ACQUIRE)) {
+        int h, w;
+        getmaxyx(stdscr, h, w);
+        __atomic_store_n(&screen_h, h, __ATOMIC_RELAXED);
+        __atomic_store_n(&screen_w, w, __ATOMIC_RELAXED);
+        draw_ui(acquire_snapshot());
+        nanosleep(&frame, NULL);
+    }
+    return NULL;
+}
+
 // FUNCTION: send_state_to_drone
-// LOGIC: Packs current Window Size (W), User Force (F), Obstacles (O), and Targets (T)
-//        into a single string to send via pipe to the Drone process.
+// LOGIC: Encodes the current world (see encode_world_state) and writes it
+//        to the Drone's pipe.
 void send_state_to_drone(float fx, float fy) {
     char msg[BUF_SIZE];
-    int offset = 0;
-    offset += sprintf(msg + offset, "W:%d,%d|F:%.2f,%.2f|", screen_w, screen_h, fx, fy);
-    offset += sprintf(msg + offset, "O:");
-    for(int i=0; i<MAX_OBSTACLES; i++) if(obstacles[i].x != 0) offset += sprintf(msg + offset, "%d,%d;", obstacles[i].x, obstacles[i].y);
-    msg[offset-1] = '|'; 
-    offset += sprintf(msg + offset, "T:");
-    for(int i=0; i<MAX_TARGETS; i++) if(targets[i].x != 0) offset += sprintf(msg + offset, "%d,%d;", targets[i].x, targets[i].y);
-    strcat(msg, "\n");
-    dprintf(pipe_server_to_drone[1], "%s", msg);
+    int len = encode_world_state(msg, __atomic_load_n(&screen_w, __ATOMIC_RELAXED),
+                                 __atomic_load_n(&screen_h, __ATOMIC_RELAXED), fx, fy, obstacles, targets);
+    write(pipe_server_to_drone[1], msg, len);
 }
 
 int main(void) {
@@ -154,6 +312,7 @@ int main(void) {
     register_process("Server");
     setup_watchdog_monitor("Server");
     start_time = time(NULL);
+    clock_gettime(CLOCK_MONOTONIC, &boot_ts);
 
     spawn_keyboard_guide(); 
     spawn_monitor("PHYSICS", LOG_DRONE, 400, 0); 
@@ -164,11 +323,18 @@ int main(void) {
 
     if (pipe(pipe_input_to_server) == -1 || pipe(pipe_server_to_drone) == -1 || 
         pipe(pipe_drone_to_server) == -1 || pipe(pipe_obstacle_to_server) == -1 || 
-        pipe(pipe_target_to_server) == -1) exit(1);
+        pipe(pipe_target_to_server) == -1 || pipe(pipe_ready) == -1) exit(1);
+
+    // --- STARTUP HANDSHAKE ---
+    // Children inherit the write end of pipe_ready (fd number passed in
+    // ENV_READY_FD) and call notify_ready() once initialised.
+    char ready_fd[16];
+    snprintf(ready_fd, sizeof(ready_fd), "%d", pipe_ready[1]);
+    setenv(ENV_READY_FD, ready_fd, 1);
+    fcntl(pipe_ready[0], F_SETFD, FD_CLOEXEC);
 
-    // [PROCESS FORKING LOGIC OMITTED FOR BREVITY - SAME AS BEFORE]
+    for (int i = 0; i < SU_COUNT; i++) startup[i].spawn_ms = elapsed_ms();
     if ((pid_wd = fork()) == 0) { execlp("xterm", "xterm", "-T", "Watchdog Process", "-geometry", "40x10+0+0", "-e", "src/watchdog/watchdog", NULL); _exit(1); }
-    sleep(1);
     if ((pid_input = fork()) == 0) { dup2(pipe_input_to_server[1], STDOUT_FILENO); close(pipe_input_to_server[0]); close(pipe_input_to_server[1]); execl("src/input/input", "input", NULL); _exit(1); }
     if ((pid_drone = fork()) == 0) { dup2(pipe_server_to_drone[0], STDIN_FILENO); dup2(pipe_drone_to_server[1], STDOUT_FILENO); close(pipe_server_to_drone[0]); close(pipe_server_to_drone[1]); close(pipe_drone_to_server[0]); close(pipe_drone_to_server[1]); execl("src/drone/drone", "drone", NULL); _exit(1); }
     if ((pid_obs = fork()) == 0) { dup2(pipe_obstacle_to_server[1], STDOUT_FILENO); close(pipe_obstacle_to_server[0]); close(pipe_obstacle_to_server[1]); execl("src/obstacle/obstacle", "obstacle", NULL); _exit(1); }
@@ -176,14 +342,29 @@ int main(void) {
 
     close(pipe_input_to_server[1]); close(pipe_server_to_drone[0]); close(pipe_drone_to_server[1]);
     close(pipe_obstacle_to_server[1]); close(pipe_target_to_server[1]);
+    close(pipe_ready[1]); unsetenv(ENV_READY_FD);
+
+    wait_ready();
+    char msg[64];
+    snprintf(msg, sizeof(msg), "STARTUP: Simulation started after %.1f ms", elapsed_ms());
+    log_message(LOG_GAME, msg);
 
     fcntl(pipe_input_to_server[0], F_SETFL, O_NONBLOCK);
     fcntl(pipe_drone_to_server[0], F_SETFL, O_NONBLOCK);
     fcntl(pipe_obstacle_to_server[0], F_SETFL, O_NONBLOCK);
     fcntl(pipe_target_to_server[0], F_SETFL, O_NONBLOCK);
+    if (pipe_ready[0] >= 0) fcntl(pipe_ready[0], F_SETFL, O_NONBLOCK);
 
     init_ncurses_safe();
-    draw_ui(0, 0);
+    publish_snapshot(0, 0);
+
+    // Render thread: signals (Watchdog SIGUSR1) stay on this I/O thread
+    pthread_t render_thread;
+    sigset_t block, old;
+    sigfillset(&block);
+    pthread_sigmask(SIG_BLOCK, &block, &old);
+    if (pthread_create(&render_thread, NULL, render_loop, NULL) != 0) { cleanup_processes(); exit(1); }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
 
     float force_x = 0, force_y = 0;
     char buf[BUF_SIZE];
@@ -191,7 +372,6 @@ int main(void) {
 
     while (1) {
         set_status("Main Loop Waiting");
-        getmaxyx(stdscr, screen_h, screen_w);
         
         // --- ASSIGNMENT 1 KEY COMPONENT: SELECT() ---
         // LOGIC: Monitors multiple file descriptors (pipes) simultaneously.
@@ -202,6 +382,7 @@ int main(void) {
         FD_SET(pipe_drone_to_server[0], &readfds);
         FD_SET(pipe_obstacle_to_server[0], &readfds);
         FD_SET(pipe_target_to_server[0], &readfds);
+        if (pipe_ready[0] >= 0) FD_SET(pipe_ready[0], &readfds);
 
         struct timeval timeout = {0, 20000};
         if (select(1024, &readfds, NULL, NULL, &timeout) < 0) {
@@ -211,40 +392,66 @@ int main(void) {
 
         set_status("Processing I/O");
 
+        // Late readiness reports (a child that missed the startup timeout)
+        if (pipe_ready[0] >= 0 && FD_ISSET(pipe_ready[0], &readfds)) read_ready_reports();
+
         if (FD_ISSET(pipe_input_to_server[0], &readfds)) {
             int n = read(pipe_input_to_server[0], buf, sizeof(buf)-1);
             if (n == 0) break; 
             if(n>0) {
+                mark_first_tick(SU_INPUT);
                 buf[n]=0; char* l=strrchr(buf,'\n'); 
                 if(l){ *l=0; char* s=strrchr(buf,'\n'); s=(s)?s+1:buf; sscanf(s,"%f,%f",&force_x,&force_y); }
             }
         }
 
         // [READING OBSTACLES AND TARGETS OMITTED FOR BREVITY - SAME AS BEFORE]
-        if (FD_ISSET(pipe_obstacle_to_server[0], &readfds)) { int n = read(pipe_obstacle_to_server[0], buf, sizeof(buf)-1); if (n > 0) { buf[n] = 0; char *ptr = buf; int ox, oy, offset; while(sscanf(ptr, "%d,%d%n", &ox, &oy, &offset) == 2) { obstacles[obs_idx].x = ox; obstacles[obs_idx].y = oy; obs_idx = (obs_idx + 1) % MAX_OBSTACLES; ptr += offset; while(*ptr == '\n' || *ptr == ' ' || *ptr == '\r') ptr++; } } }
-        if (FD_ISSET(pipe_target_to_server[0], &readfds)) { int n = read(pipe_target_to_server[0], buf, sizeof(buf)-1); if (n > 0) { buf[n] = 0; char *ptr = buf; int tx, ty, offset; while(sscanf(ptr, "%d,%d%n", &tx, &ty, &offset) == 2) { targets[tar_idx].x = tx; targets[tar_idx].y = ty; tar_idx = (tar_idx + 1) % MAX_TARGETS; ptr += offset; while(*ptr == '\n' || *ptr == ' ' || *ptr == '\r') ptr++; } } }
+        if (FD_ISSET(pipe_obstacle_to_server[0], &readfds)) { int n = read(pipe_obstacle_to_server[0], buf, sizeof(buf)-1); if (n > 0) { mark_first_tick(SU_OBSTACLES); buf[n] = 0; char *ptr = buf; int ox, oy, offset; while(sscanf(ptr, "%d,%d%n", &ox, &oy, &offset) == 2) { obstacles[obs_idx].x = ox; obstacles[obs_idx].y = oy; obs_idx = (obs_idx + 1) % MAX_OBSTACLES; ptr += offset; while(*ptr == '\n' || *ptr == ' ' || *ptr == '\r') ptr++; } } }
+        if (FD_ISSET(pipe_target_to_server[0], &readfds)) { int n = read(pipe_target_to_server[0], buf, sizeof(buf)-1); if (n > 0) { mark_first_tick(SU_TARGETS); buf[n] = 0; char *ptr = buf; int tx, ty, offset; while(sscanf(ptr, "%d,%d%n", &tx, &ty, &offset) == 2) { targets[tar_idx].x = tx; targets[tar_idx].y = ty; tar_idx = (tar_idx + 1) % MAX_TARGETS; ptr += offset; while(*ptr == '\n' || *ptr == ' ' || *ptr == '\r') ptr++; } } }
         
         send_state_to_drone(force_x, force_y);
 
         if (FD_ISSET(pipe_drone_to_server[0], &readfds)) {
-            int n = read(pipe_drone_to_server[0], buf, sizeof(buf)-1);
+            // A partial last line is kept and completed by the next read.
+            static char drone_buf[BUF_SIZE];
+            static int drone_len = 0;
+            int n = read(pipe_drone_to_server[0], drone_buf + drone_len, sizeof(drone_buf)-1 - drone_len);
             if(n>0) {
-                buf[n]=0; char* l=strrchr(buf,'\n'); 
-                if(l){ *l=0; char* s=strrchr(buf,'\n'); s=(s)?s+1:buf; sscanf(s,"%f,%f",&drone_x,&drone_y); }
-                
+                mark_first_tick(SU_DRONE);
+                drone_len += n; drone_buf[drone_len] = 0;
+
+                // Sweep every queued sample pair, so collisions follow the path
+                // actually flown and not a straight line to the newest sample.
                 static float last_x = -1, last_y = -1;
-                if (last_x != -1) {
-                    float dist_inc = sqrt(pow(drone_x - last_x, 2) + pow(drone_y - last_y, 2));
-                    total_distance += dist_inc;
+                float path_x = last_x, path_y = last_y, path_len = 0;
+                char *line = drone_buf, *nl;
+                while ((nl = strchr(line, '\n'))) {
+                    *nl = 0;
+                    float px, py;
+                    if (sscanf(line, "%f,%f", &px, &py) == 2) {
+                        if (path_x == -1) { path_x = px; path_y = py; }
+                        check_collisions(targets, obstacles, path_x, path_y, px, py, &targets_collected, &obstacles_hit);
+                        path_len += sqrt(pow(px - path_x, 2) + pow(py - path_y, 2));
+                        path_x = px; path_y = py;
+                    }
+                    line = nl + 1;
+                }
+                drone_len -= line - drone_buf;
+                memmove(drone_buf, line, drone_len);
+                if (drone_len == sizeof(drone_buf)-1) drone_len = 0; // Garbage without newline
+
+                if (path_x != -1) {
+                    drone_x = path_x; drone_y = path_y;
+                    total_distance += path_len;
+                    last_x = path_x; last_y = path_y;
                 }
-                last_x = drone_x; last_y = drone_y;
-
-                check_collisions();
                 final_score = targets_collected * 100;
             }
         }
-        draw_ui(force_x, force_y);
+        publish_snapshot(force_x, force_y);
     }
+    __atomic_store_n(&running, 0, __ATOMIC_RELEASE);
+    pthread_join(render_thread, NULL);
     cleanup_processes();
     return 0;
 }
@@ -3,6 +3,7 @@
 int main(int argc, char *argv[]) {
     register_process("Targets");
     setup_watchdog_monitor("Targets");
+    notify_ready("Targets");
 
     srand(time(NULL) ^ getpid() ^ 999);
     int max_w = DEFAULT_WIDTH;
@@ -37,6 +37,7 @@ int main() {
     FILE *f = fopen(LOG_WATCHDOG, "w"); if(f) fclose(f);
     
     register_process("Watchdog");
+    notify_ready("Watchdog");
 
     mvprintw(0, 0, "--- WATCHDOG MONITOR ---");
     refresh();